@@ -0,0 +1,141 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "../include/yamjson.h"
+
+/**
+ * YamJSON 路径访问性能测试
+ * 对比热循环中读取同一个深层节点的几种方式：
+ *   1. 链式 operator[]（原有写法）
+ *   2. std::vector<std::string> 路径逐级 contains + operator[]（update_value 的原有写法）
+ *   3. Path::get（预编译路径，不缓存）
+ *   4. YamJSON::get_cached（预编译路径，调用方持有的 CachedPath 缓存解析结果）
+ * 以及写入同一个深层节点：
+ *   1. update_value 原有写法（每级 contains + 两次 operator[]）
+ *   2. YamJSON::update_value（每级一次查找）
+ *   3. Path::set
+ */
+
+// 防止编译器把循环优化掉
+static volatile long long g_sink = 0;
+
+template<typename Func>
+void run_case(const std::string &name, size_t iterations, Func &&func) {
+    auto start = std::chrono::steady_clock::now();
+    long long sum = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        sum += func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    g_sink = g_sink + sum;
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    std::cout << "  " << name << ": " << ns << " ns/次" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    size_t iterations = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+    // 构造一个有一定宽度和深度的配置文档
+    nlohmann::json data = nlohmann::json::object();
+    for (int i = 0; i < 64; ++i) {
+        data["section_" + std::to_string(i)]["enabled"] = (i % 2 == 0);
+    }
+    nlohmann::json users = nlohmann::json::array();
+    for (int i = 0; i < 32; ++i) {
+        users.push_back({{"name", "user_" + std::to_string(i)}, {"level", i}});
+    }
+    data["service"]["cluster"]["nodes"]["primary"]["limits"]["max_connections"] = 1024;
+    data["service"]["users"] = users;
+
+    yamjson::YamJSON config = yamjson::YamJSON::from_json(data);
+    const yamjson::YamJSON &const_config = config;
+    const nlohmann::json &root = const_config.get_json();
+
+    const std::vector<std::string> keys = {"service", "cluster", "nodes", "primary", "limits", "max_connections"};
+    const yamjson::Path path("service.cluster.nodes.primary.limits.max_connections");
+    const yamjson::Path index_path("/service/users/17/level");
+    yamjson::CachedPath cached(path);
+    yamjson::CachedPath cached_index(index_path);
+
+    std::cout << "===== 深层键访问（6 级，迭代 " << iterations << " 次）=====" << std::endl;
+
+    run_case("链式 operator[]        ", iterations, [&]() {
+        return config["service"]["cluster"]["nodes"]["primary"]["limits"]["max_connections"].get<long long>();
+    });
+
+    run_case("vector 路径 contains+[]", iterations, [&]() {
+        const nlohmann::json *current = &root;
+        for (const auto &key : keys) {
+            if (!current->contains(key)) {
+                return 0LL;
+            }
+            current = &(*current)[key];
+        }
+        return current->get<long long>();
+    });
+
+    run_case("Path::get（不缓存）    ", iterations, [&]() {
+        return path.get(root)->get<long long>();
+    });
+
+    run_case("YamJSON::get_cached    ", iterations, [&]() {
+        return const_config.get_cached(cached)->get<long long>();
+    });
+
+    std::cout << "\n===== 数组下标访问（迭代 " << iterations << " 次）=====" << std::endl;
+
+    run_case("链式 operator[]        ", iterations, [&]() {
+        return config["service"]["users"][17]["level"].get<long long>();
+    });
+
+    run_case("Path::get（不缓存）    ", iterations, [&]() {
+        return index_path.get(root)->get<long long>();
+    });
+
+    run_case("YamJSON::get_cached    ", iterations, [&]() {
+        return const_config.get_cached(cached_index)->get<long long>();
+    });
+
+    std::cout << "\n===== 缺失键查询（迭代 " << iterations << " 次）=====" << std::endl;
+
+    const yamjson::Path missing("service.cluster.nodes.backup.limits");
+    run_case("Path::get（不缓存）    ", iterations, [&]() {
+        return missing.get(root) == nullptr ? 1LL : 0LL;
+    });
+
+    std::cout << "\n===== 深层键写入（6 级，迭代 " << iterations << " 次）=====" << std::endl;
+
+    nlohmann::json &data_ref = config.get_json();
+    run_case("update_value 原有写法  ", iterations, [&]() {
+        nlohmann::json *current = &data_ref;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            const std::string &key = keys[i];
+            if (i == keys.size() - 1) {
+                (*current)[key] = static_cast<long long>(i);
+                return 1LL;
+            }
+            if (!current->contains(key) || !(*current)[key].is_object()) {
+                (*current)[key] = nlohmann::json::object();
+            }
+            current = &(*current)[key];
+        }
+        return 0LL;
+    });
+
+    run_case("YamJSON::update_value  ", iterations, [&]() {
+        return config.update_value(keys, 1024) ? 1LL : 0LL;
+    });
+
+    run_case("Path::set              ", iterations, [&]() {
+        return path.set(data_ref, 1024) ? 1LL : 0LL;
+    });
+
+    // 链式 operator[] 读取缺失键会插入 null 节点，Path 不会
+    config["service"]["cluster"]["nodes"]["backup"];
+    std::cout << "  operator[] 读取后插入了缺失键: "
+              << (const_config.contains("service.cluster.nodes.backup") ? "是" : "否") << std::endl;
+
+    return 0;
+}
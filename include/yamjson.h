@@ -17,6 +17,82 @@ namespace yamjson{
     std::string json_to_yaml(const nlohmann::json &j);
     YAML::Node json_to_yaml_node(const nlohmann::json &j);
 
+    // 路径类：Path - 预编译的访问路径，解析一次后可反复使用
+    // 支持两种语法：
+    //   JSON Pointer: "/server/port"、"/users/0/name"（~0 表示 '~'，~1 表示 '/'，在数组上 "-" 表示末尾，在对象上是普通键名）
+    //   点号语法:     "server.port"、"users[0].name"、"users[*].name"、"users.*.roles"
+    // 点号语法中的 "*" 段表示通配符，匹配对象或数组的所有子节点；JSON Pointer 中的 "*" 是普通键名
+    // 点号语法中的方括号下标 [n] 只匹配数组，不带方括号的数字段在对象上按键名访问
+    class Path{
+    public:
+        // 路径片段
+        struct Token{
+            enum class Kind{ Key,Index,Wildcard,Append };
+            Kind kind;
+            std::string key;   // 键名（Index 类型同时保留原始文本，以便在对象上按键访问）
+            size_t index;      // 数组下标，仅 Index 类型有效
+            bool bracket=false;  // 来自点号语法的 [n]，只匹配数组
+        };
+
+        // 构造函数
+        Path(){}
+        Path(const char *expr);
+        Path(const std::string &expr);
+        explicit Path(const std::vector<std::string> &keys);  // 每个元素视为一个对象键
+
+        // 工厂方法
+        static Path parse(const std::string &expr){ return Path(expr); }
+
+        // 路径信息
+        const std::vector<Token> &tokens() const{ return tokens_; }
+        bool empty() const{ return tokens_.empty(); }
+        bool has_wildcard() const{ return has_wildcard_; }
+        std::string to_pointer() const;  // 转换为 JSON Pointer 字符串，含通配符时抛出异常
+
+        // 查询（不会插入缺失的键），未命中返回 nullptr；通配符路径返回第一个匹配
+        const nlohmann::json *get(const nlohmann::json &root) const;
+        nlohmann::json *get(nlohmann::json &root) const;
+        std::vector<const nlohmann::json *> query(const nlohmann::json &root) const;  // 返回所有匹配
+        bool contains(const nlohmann::json &root) const{ return get(root)!=nullptr; }
+
+        // 修改：set 会按 update_value 的规则创建缺失的中间对象，通配符只作用于已存在的节点
+        // 缺失节点遇到 "-" 或 [0] 时创建数组，遇到其他方括号下标时写入失败；空路径返回 false
+        bool set(nlohmann::json &root,const nlohmann::json &value) const;
+        size_t erase(nlohmann::json &root) const;  // 返回删除的节点数
+
+    private:
+        std::vector<Token> tokens_;
+        bool has_wildcard_=false;
+
+        void parse_pointer(const std::string &expr);
+        void parse_dotted(const std::string &expr);
+        void push_segment(const std::string &segment,bool allow_wildcard);
+    };
+
+    // 缓存路径：CachedPath - 由调用方持有的查询缓存，用于在不变的文档上反复读取同一节点
+    // 第一次命中后保存节点指针，之后对同一根节点的查询直接返回该指针，不再检查文档
+    // 警告：缓存无法感知文档的任何修改。文档被修改（包括通过 get_json()、operator[] 取得的引用修改）、
+    //       移动或销毁后必须调用 reset()，否则 get 可能返回已释放或错误的节点
+    // 每个 CachedPath 只应由一个线程使用；需要判断节点是否存在时请使用 Path/YamJSON 的 contains
+    class CachedPath{
+    public:
+        CachedPath(){}
+        CachedPath(const Path &path) : path_(path) {}
+
+        const Path &path() const{ return path_; }
+
+        // 未命中时不缓存，下次会重新查找
+        const nlohmann::json *get(const nlohmann::json &root);
+
+        // 丢弃缓存的查询结果
+        void reset(){ root_=nullptr; node_=nullptr; }
+
+    private:
+        Path path_;
+        const nlohmann::json *root_=nullptr;  // 缓存对应的根节点
+        const nlohmann::json *node_=nullptr;  // 缓存的查询结果
+    };
+
     // 核心类：YamJSON - 统一的YAML/JSON处理接口
     class YamJSON{
     private:
@@ -66,6 +142,16 @@ namespace yamjson{
         // 路径更新
         bool update_value(const std::vector<std::string> &path,const nlohmann::json &value);
 
+        // 预编译路径访问（不会插入缺失的键）
+        const nlohmann::json *get(const Path &path) const{ return path.get(json_data_); }
+        std::vector<const nlohmann::json *> query(const Path &path) const{ return path.query(json_data_); }
+        bool contains(const Path &path) const{ return path.contains(json_data_); }
+
+        // 带缓存的查询：结果保存在调用方持有的 cached 中，文档的任何修改都需要调用方执行 cached.reset()
+        const nlohmann::json *get_cached(CachedPath &cached) const{ return cached.get(json_data_); }
+        bool set(const Path &path,const nlohmann::json &value);
+        size_t erase(const Path &path);
+
         // 操作符重载
         template<typename T>
         auto operator[](T &&key) -> decltype(std::declval<nlohmann::json>()[std::forward<T>(key)]){
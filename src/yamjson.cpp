@@ -122,6 +122,362 @@ namespace yamjson{
         }
     }
 
+    //========== Path 实现 ==========
+
+    namespace{
+        using Token = Path::Token;
+
+        // 判断是否为合法的数组下标（不允许前导零，与 JSON Pointer 规范一致）
+        bool parse_index(const std::string &s, size_t &index) {
+            if (s.empty() || s.size() > 18 || (s.size() > 1 && s[0] == '0')) {
+                return false;
+            }
+            size_t value = 0;
+            for (char c : s) {
+                if (c < '0' || c > '9') {
+                    return false;
+                }
+                value = value * 10 + static_cast<size_t>(c - '0');
+            }
+            index = value;
+            return true;
+        }
+
+        // 单步查找，不会插入缺失的键
+        template<typename Json>
+        Json *step(Json &node, const Token &token) {
+            if (node.is_object()) {
+                // 对象上的 "-" 是普通键名（RFC 6901）；方括号下标只匹配数组
+                if (token.kind == Token::Kind::Wildcard || token.bracket) {
+                    return nullptr;
+                }
+                auto it = node.find(token.key);
+                return it == node.end() ? nullptr : &*it;
+            }
+            if (node.is_array() && token.kind == Token::Kind::Index && token.index < node.size()) {
+                return &node[token.index];
+            }
+            return nullptr;
+        }
+
+        // 收集所有匹配节点，first_only 为真时找到第一个即停止
+        template<typename Json>
+        bool collect(Json &node, const std::vector<Token> &tokens, size_t pos,
+                     std::vector<Json *> &out, bool first_only) {
+            Json *current = &node;
+            for (; pos < tokens.size(); ++pos) {
+                if (tokens[pos].kind == Token::Kind::Wildcard) {
+                    if (!current->is_object() && !current->is_array()) {
+                        return false;
+                    }
+                    for (auto &child : *current) {
+                        if (collect(child, tokens, pos + 1, out, first_only) && first_only) {
+                            return true;
+                        }
+                    }
+                    return !out.empty();
+                }
+                current = step(*current, tokens[pos]);
+                if (current == nullptr) {
+                    return false;
+                }
+            }
+            out.push_back(current);
+            return true;
+        }
+
+        // 按路径写入，返回写入的节点数；last_wildcard 为最后一个通配符的位置，没有时等于 tokens.size()
+        size_t set_at(nlohmann::json &node, const std::vector<Token> &tokens, size_t pos,
+                      size_t last_wildcard, const nlohmann::json &value) {
+            if (pos == tokens.size()) {
+                node = value;
+                return 1;
+            }
+            const Token &token = tokens[pos];
+
+            if (token.kind == Token::Kind::Wildcard) {
+                if (!node.is_object() && !node.is_array()) {
+                    return 0;
+                }
+                size_t count = 0;
+                for (auto &child : node) {
+                    count += set_at(child, tokens, pos + 1, last_wildcard, value);
+                }
+                return count;
+            }
+
+            // 与 update_value 一致：缺失或非容器的中间节点替换为对象
+            // "-" 和方括号下标 [0] 替换为数组，其他方括号下标无法在新数组上成立，直接放弃
+            // 后面还有通配符时新建的容器必然为空，同样直接放弃以免改动原有数据
+            if (!node.is_object() && !node.is_array()) {
+                if (last_wildcard != tokens.size() && pos < last_wildcard) {
+                    return 0;
+                }
+                if (token.bracket && token.index != 0) {
+                    return 0;
+                }
+                bool as_array = token.kind == Token::Kind::Append || token.bracket;
+                node = as_array ? nlohmann::json::array() : nlohmann::json::object();
+            }
+
+            if (node.is_array()) {
+                size_t index;
+                if (token.kind == Token::Kind::Append) {
+                    index = node.size();
+                } else if (token.kind == Token::Kind::Index && token.index <= node.size()) {
+                    index = token.index;
+                } else {
+                    return 0;
+                }
+                if (index < node.size()) {
+                    return set_at(node[index], tokens, pos + 1, last_wildcard, value);
+                }
+                node.push_back(nullptr);
+                size_t count = set_at(node.back(), tokens, pos + 1, last_wildcard, value);
+                if (count == 0) {
+                    node.erase(node.size() - 1);
+                }
+                return count;
+            }
+
+            if (token.bracket) {
+                return 0;
+            }
+            auto inserted = node.emplace(token.key, nullptr);
+            size_t count = set_at(inserted.first.value(), tokens, pos + 1, last_wildcard, value);
+            if (count == 0 && inserted.second) {
+                node.erase(inserted.first);
+            }
+            return count;
+        }
+
+        // 按路径删除，返回删除的节点数
+        size_t erase_at(nlohmann::json &node, const std::vector<Token> &tokens, size_t pos) {
+            const Token &token = tokens[pos];
+            bool last = pos + 1 == tokens.size();
+
+            if (token.kind == Token::Kind::Wildcard) {
+                if (!node.is_object() && !node.is_array()) {
+                    return 0;
+                }
+                if (last) {
+                    size_t count = node.size();
+                    node.clear();
+                    return count;
+                }
+                size_t count = 0;
+                for (auto &child : node) {
+                    count += erase_at(child, tokens, pos + 1);
+                }
+                return count;
+            }
+
+            if (!last) {
+                nlohmann::json *child = step(node, token);
+                return child == nullptr ? 0 : erase_at(*child, tokens, pos + 1);
+            }
+
+            if (node.is_object()) {
+                return token.bracket ? 0 : node.erase(token.key);
+            }
+            if (node.is_array() && token.kind == Token::Kind::Index && token.index < node.size()) {
+                node.erase(token.index);
+                return 1;
+            }
+            return 0;
+        }
+    }
+
+    Path::Path(const char *expr) : Path(std::string(expr ? expr : "")) {}
+
+    Path::Path(const std::string &expr) {
+        if (expr.empty()) {
+            return;  // 空路径表示根节点
+        }
+        if (expr[0] == '/') {
+            parse_pointer(expr);
+        } else {
+            parse_dotted(expr);
+        }
+    }
+
+    Path::Path(const std::vector<std::string> &keys) {
+        tokens_.reserve(keys.size());
+        for (const auto &key : keys) {
+            tokens_.push_back(Token{Token::Kind::Key, key, 0});
+        }
+    }
+
+    void Path::push_segment(const std::string &segment, bool allow_wildcard) {
+        Token token{Token::Kind::Key, segment, 0};
+        if (allow_wildcard && segment == "*") {
+            token.kind = Token::Kind::Wildcard;
+            has_wildcard_ = true;
+        } else if (parse_index(segment, token.index)) {
+            token.kind = Token::Kind::Index;
+        }
+        tokens_.push_back(token);
+    }
+
+    // JSON Pointer (RFC 6901)，"*" 是普通键名
+    void Path::parse_pointer(const std::string &expr) {
+        size_t start = 1;
+        while (true) {
+            size_t end = expr.find('/', start);
+            if (end == std::string::npos) {
+                end = expr.size();
+            }
+            std::string segment;
+            segment.reserve(end - start);
+            for (size_t i = start; i < end; ++i) {
+                if (expr[i] != '~') {
+                    segment += expr[i];
+                } else if (i + 1 < end && expr[i + 1] == '0') {
+                    segment += '~';
+                    ++i;
+                } else if (i + 1 < end && expr[i + 1] == '1') {
+                    segment += '/';
+                    ++i;
+                } else {
+                    throw std::runtime_error("路径解析错误: 非法的转义序列 '" + expr + "'");
+                }
+            }
+            if (segment == "-") {
+                tokens_.push_back(Token{Token::Kind::Append, segment, 0});
+            } else {
+                push_segment(segment, false);
+            }
+            if (end == expr.size()) {
+                break;
+            }
+            start = end + 1;
+        }
+    }
+
+    // 点号语法：a.b[0].c、a[*].b、a.*.b
+    void Path::parse_dotted(const std::string &expr) {
+        size_t i = 0;
+        while (i < expr.size()) {
+            if (expr[i] == '[') {
+                size_t close = expr.find(']', i);
+                if (close == std::string::npos) {
+                    throw std::runtime_error("路径解析错误: 缺少 ']' '" + expr + "'");
+                }
+                std::string inner = expr.substr(i + 1, close - i - 1);
+                Token token{Token::Kind::Index, inner, 0, true};
+                if (inner == "*") {
+                    token.kind = Token::Kind::Wildcard;
+                    has_wildcard_ = true;
+                } else if (!parse_index(inner, token.index)) {
+                    throw std::runtime_error("路径解析错误: 非法的数组下标 '" + expr + "'");
+                }
+                tokens_.push_back(token);
+                i = close + 1;
+            } else {
+                size_t end = expr.find_first_of(".[]", i);
+                if (end == std::string::npos) {
+                    end = expr.size();
+                } else if (expr[end] == ']') {
+                    throw std::runtime_error("路径解析错误: 多余的 ']' '" + expr + "'");
+                }
+                if (end == i) {
+                    throw std::runtime_error("路径解析错误: 空的路径片段 '" + expr + "'");
+                }
+                push_segment(expr.substr(i, end - i), true);
+                i = end;
+            }
+
+            // 片段之间只能是 '.' 或 '['
+            if (i < expr.size() && expr[i] == '.') {
+                if (++i == expr.size()) {
+                    throw std::runtime_error("路径解析错误: 路径不能以 '.' 结尾 '" + expr + "'");
+                }
+                if (expr[i] == '[') {
+                    throw std::runtime_error("路径解析错误: '.' 后不能紧跟 '[' '" + expr + "'");
+                }
+            } else if (i < expr.size() && expr[i] != '[') {
+                throw std::runtime_error("路径解析错误: ']' 后缺少 '.' '" + expr + "'");
+            }
+        }
+    }
+
+    std::string Path::to_pointer() const {
+        std::string result;
+        for (const auto &token : tokens_) {
+            // JSON Pointer 没有通配符，"/*" 只能表示键名 "*"
+            if (token.kind == Token::Kind::Wildcard) {
+                throw std::runtime_error("路径转换错误: 通配符路径无法表示为 JSON Pointer");
+            }
+            result += '/';
+            for (char c : token.key) {
+                if (c == '~') {
+                    result += "~0";
+                } else if (c == '/') {
+                    result += "~1";
+                } else {
+                    result += c;
+                }
+            }
+        }
+        return result;
+    }
+
+    const nlohmann::json *Path::get(const nlohmann::json &root) const {
+        if (!has_wildcard_) {
+            const nlohmann::json *current = &root;
+            for (const auto &token : tokens_) {
+                current = step(*current, token);
+                if (current == nullptr) {
+                    return nullptr;
+                }
+            }
+            return current;
+        }
+        std::vector<const nlohmann::json *> out;
+        collect(root, tokens_, 0, out, true);
+        return out.empty() ? nullptr : out.front();
+    }
+
+    nlohmann::json *Path::get(nlohmann::json &root) const {
+        return const_cast<nlohmann::json *>(get(static_cast<const nlohmann::json &>(root)));
+    }
+
+    std::vector<const nlohmann::json *> Path::query(const nlohmann::json &root) const {
+        std::vector<const nlohmann::json *> out;
+        collect(root, tokens_, 0, out, false);
+        return out;
+    }
+
+    bool Path::set(nlohmann::json &root, const nlohmann::json &value) const {
+        if (tokens_.empty()) {
+            return false;  // 与 update_value 一致，空路径不替换根节点
+        }
+        size_t last_wildcard = tokens_.size();
+        for (size_t i = 0; i < tokens_.size(); ++i) {
+            if (tokens_[i].kind == Token::Kind::Wildcard) {
+                last_wildcard = i;
+            }
+        }
+        return set_at(root, tokens_, 0, last_wildcard, value) > 0;
+    }
+
+    size_t Path::erase(nlohmann::json &root) const {
+        if (tokens_.empty()) {
+            return 0;  // 不能删除根节点
+        }
+        return erase_at(root, tokens_, 0);
+    }
+
+    const nlohmann::json *CachedPath::get(const nlohmann::json &root) {
+        if (node_ != nullptr && root_ == &root) {
+            return node_;
+        }
+        const nlohmann::json *node = path_.get(root);
+        root_ = node == nullptr ? nullptr : &root;
+        node_ = node;
+        return node;
+    }
+
     //========== YamJSON 实现 ==========
 
     // 构造函数
@@ -381,13 +737,14 @@ namespace yamjson{
                     return true;
                 }
 
-                // 检查中间节点是否存在
-                if (!current->contains(key) || !(*current)[key].is_object()) {
-                    (*current)[key] = nlohmann::json::object();
+                // 只查找一次：不存在时 operator[] 会插入 null，随后统一替换为对象
+                nlohmann::json &next = (*current)[key];
+                if (!next.is_object()) {
+                    next = nlohmann::json::object();
                 }
 
                 // 移动到下一级
-                current = &(*current)[key];
+                current = &next;
             }
 
             return false; // 空路径
@@ -397,6 +754,20 @@ namespace yamjson{
         }
     }
 
+    // 预编译路径访问
+    bool YamJSON::set(const Path &path, const nlohmann::json &value) {
+        try {
+            return path.set(json_data_, value);
+        }
+        catch (const std::exception &e) {
+            return false;
+        }
+    }
+
+    size_t YamJSON::erase(const Path &path) {
+        return path.erase(json_data_);
+    }
+
     // 赋值操作符
     YamJSON& YamJSON::operator=(const nlohmann::json &json_data) {
         json_data_ = json_data;